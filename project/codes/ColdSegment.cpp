@@ -0,0 +1,256 @@
+/**
+ * @file ColdSegment.cpp
+ * @brief Implementation of the paged cold-field segment and its buffer pool
+ */
+
+#include "ColdSegment.h"
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+using namespace std;
+
+/**
+ * @brief Write bytes at a file offset without using the shared file position
+ * @param file Segment file
+ * @param offset Byte offset from the start of the file
+ * @param data Bytes to write
+ * @param length Number of bytes
+ * @return true if every byte was written, false otherwise
+ */
+static bool writeAt(FILE* file, unsigned long long offset, const char* data, size_t length) {
+#ifdef _WIN32
+    HANDLE handle = (HANDLE)_get_osfhandle(_fileno(file));
+    OVERLAPPED position = {};
+    position.Offset = (DWORD)offset;
+    position.OffsetHigh = (DWORD)(offset >> 32);
+    DWORD written = 0;
+    return WriteFile(handle, data, (DWORD)length, &written, &position) && written == length;
+#else
+    while (length > 0) {
+        ssize_t written = pwrite(fileno(file), data, length, (off_t)offset);
+        if (written <= 0) return false;
+        offset += written;
+        data += written;
+        length -= written;
+    }
+    return true;
+#endif
+}
+
+/**
+ * @brief Read bytes at a file offset without using the shared file position
+ * @details Safe to call from several threads at once
+ * @param file Segment file
+ * @param offset Byte offset from the start of the file
+ * @param out Destination buffer
+ * @param length Number of bytes
+ * @return true if every byte was read, false otherwise
+ */
+static bool readAt(FILE* file, unsigned long long offset, char* out, size_t length) {
+#ifdef _WIN32
+    HANDLE handle = (HANDLE)_get_osfhandle(_fileno(file));
+    OVERLAPPED position = {};
+    position.Offset = (DWORD)offset;
+    position.OffsetHigh = (DWORD)(offset >> 32);
+    DWORD done = 0;
+    return ReadFile(handle, out, (DWORD)length, &done, &position) && done == length;
+#else
+    while (length > 0) {
+        ssize_t done = pread(fileno(file), out, length, (off_t)offset);
+        if (done <= 0) return false;
+        offset += done;
+        out += done;
+        length -= done;
+    }
+    return true;
+#endif
+}
+
+/**
+ * @brief ColdSegment constructor - creates the temporary segment file
+ * @param pageBytes Bytes per page
+ * @param maxPoolPages Maximum number of pages cached in memory
+ */
+ColdSegment::ColdSegment(size_t pageBytes, size_t maxPoolPages)
+    : file(tmpfile()), pageSize(pageBytes), poolPages(maxPoolPages ? maxPoolPages : 1),
+      pageCount(0), tailPage(pageBytes, 0), tailUsed(0) {
+    if (!file) {
+        throw runtime_error("Error creating cold segment file!");
+    }
+}
+
+/**
+ * @brief ColdSegment destructor - the temporary file is removed on close
+ * @details All I/O goes through writeAt()/readAt(), so there is no stdio
+ *          buffer to flush
+ */
+ColdSegment::~ColdSegment() {
+    fclose(file);
+}
+
+/**
+ * @brief Write the tail page to disk and start a new one
+ * @throws runtime_error if the page cannot be written
+ */
+void ColdSegment::flushTail() {
+    if (!writeAt(file, pageCount * pageSize, tailPage.data(), pageSize)) {
+        throw runtime_error("Error writing cold segment page!");
+    }
+    pageCount++;
+    fill(tailPage.begin(), tailPage.end(), 0);
+    tailUsed = 0;
+}
+
+/**
+ * @brief Append bytes, spilling full pages to disk
+ * @param data Bytes to append
+ * @param length Number of bytes
+ */
+void ColdSegment::append(const char* data, size_t length) {
+    while (length > 0) {
+        size_t chunk = min(length, pageSize - tailUsed);
+        memcpy(tailPage.data() + tailUsed, data, chunk);
+        tailUsed += chunk;
+        data += chunk;
+        length -= chunk;
+        if (tailUsed == pageSize) flushTail();
+    }
+}
+
+/**
+ * @brief Find a page in memory (caller holds poolMutex)
+ * @param number Page number
+ * @return Pointer to pageSize bytes, nullptr if the page is not cached
+ */
+const char* ColdSegment::cachedPage(unsigned long long number) {
+    if (number == pageCount) return tailPage.data();
+
+    auto found = poolIndex.find(number);
+    if (found == poolIndex.end()) return nullptr;
+    pool.splice(pool.begin(), pool, found->second);
+    return pool.front().second.data();
+}
+
+/**
+ * @brief Put a page read from disk into the pool (caller holds poolMutex)
+ * @details Reuses the least recently used page when the pool is full. The
+ *          page buffer is swapped in, so buffer gets the evicted page's memory.
+ * @param number Page number
+ * @param buffer Page contents
+ */
+void ColdSegment::cachePage(unsigned long long number, vector<char>& buffer) {
+    // Another reader may have cached the same page meanwhile
+    if (poolIndex.count(number)) return;
+
+    if (pool.size() >= poolPages) {
+        poolIndex.erase(pool.back().first);
+        pool.splice(pool.begin(), pool, prev(pool.end()));
+        pool.front().first = number;
+        pool.front().second.swap(buffer);
+    } else {
+        pool.emplace_front(number, buffer);
+    }
+    poolIndex[number] = pool.begin();
+}
+
+/**
+ * @brief Copy bytes out of the segment, page by page
+ * @details Cached pages are copied under poolMutex; a missing page is read
+ *          from disk without holding it, so readers of cached pages do not
+ *          wait behind disk I/O
+ * @param offset Start offset in the segment
+ * @param out Destination buffer
+ * @param length Number of bytes
+ * @throws runtime_error if a page cannot be read
+ */
+void ColdSegment::read(unsigned long long offset, char* out, size_t length) {
+    vector<char> missed;
+    while (length > 0) {
+        unsigned long long number = offset / pageSize;
+        size_t inPage = offset % pageSize;
+        size_t chunk = min(length, pageSize - inPage);
+
+        bool cached;
+        {
+            lock_guard<mutex> guard(poolMutex);
+            const char* data = cachedPage(number);
+            cached = (data != nullptr);
+            if (cached) memcpy(out, data + inPage, chunk);
+        }
+        if (!cached) {
+            // Written pages never change (until reset), so no lock is needed
+            missed.resize(pageSize);
+            if (!readAt(file, number * pageSize, missed.data(), pageSize)) {
+                throw runtime_error("Error reading cold segment page!");
+            }
+            memcpy(out, missed.data() + inPage, chunk);
+            lock_guard<mutex> guard(poolMutex);
+            cachePage(number, missed);
+        }
+        offset += chunk;
+        out += chunk;
+        length -= chunk;
+    }
+}
+
+/**
+ * @brief Store author and category in the segment
+ * @details A record that fits in one page never crosses a page boundary,
+ *          so loading it costs at most one page read
+ * @param author Book author
+ * @param category Book category
+ * @return Offset of the record
+ */
+unsigned long long ColdSegment::store(const string& author, const string& category) {
+    lock_guard<mutex> guard(poolMutex);
+    unsigned int lengths[2] = { (unsigned int)author.size(), (unsigned int)category.size() };
+    size_t recordSize = sizeof(lengths) + author.size() + category.size();
+
+    if (tailUsed > 0 && tailUsed + recordSize > pageSize && recordSize <= pageSize) {
+        flushTail();
+    }
+    unsigned long long offset = pageCount * pageSize + tailUsed;
+    append((const char*)lengths, sizeof(lengths));
+    append(author.data(), author.size());
+    append(category.data(), category.size());
+    return offset;
+}
+
+/**
+ * @brief Load author and category from the segment
+ * @param offset Offset returned by store()
+ * @param author Book author
+ * @param category Book category
+ */
+void ColdSegment::load(unsigned long long offset, string& author, string& category) {
+    unsigned int lengths[2];
+    read(offset, (char*)lengths, sizeof(lengths));
+    offset += sizeof(lengths);
+
+    author.resize(lengths[0]);
+    category.resize(lengths[1]);
+    if (lengths[0] > 0) read(offset, &author[0], lengths[0]);
+    if (lengths[1] > 0) read(offset + lengths[0], &category[0], lengths[1]);
+}
+
+/**
+ * @brief Forget every record and start writing from the first page again
+ * @details The file is not truncated; its pages are overwritten as new
+ *          records are stored. Must not run while another thread loads.
+ */
+void ColdSegment::reset() {
+    lock_guard<mutex> guard(poolMutex);
+    pool.clear();
+    poolIndex.clear();
+    pageCount = 0;
+    fill(tailPage.begin(), tailPage.end(), 0);
+    tailUsed = 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file ColdSegment.h
+ * @brief On-disk segment for rarely used book fields with a bounded buffer pool
+ * @details Author and category text is appended to a temporary file split into
+ *          fixed-size pages. Pages are read back on demand and cached in a
+ *          least-recently-used pool that never holds more than poolPages pages.
+ *          Pages are read with positioned reads outside the pool lock, so
+ *          concurrent readers only share the lock for in-memory copies.
+ *          The segment is append-only and lives only as long as the program:
+ *          it is rebuilt from the data file on every start. I/O errors are
+ *          reported with runtime_error.
+ */
+
+#ifndef COLD_SEGMENT_H
+#define COLD_SEGMENT_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+using namespace std;
+
+/**
+ * @brief Append-only page file for cold (descriptive) book fields
+ */
+class ColdSegment {
+private:
+    typedef list<pair<unsigned long long, vector<char> > > PagePool;
+
+    FILE* file;                     // Temporary segment file
+    size_t pageSize;                // Bytes per page
+    size_t poolPages;               // Maximum pages kept in memory
+    unsigned long long pageCount;   // Full pages already written to file
+    vector<char> tailPage;          // Page being filled (not yet on disk)
+    size_t tailUsed;                // Bytes used in tailPage
+    PagePool pool;                  // Cached pages, most recently used first
+    unordered_map<unsigned long long, PagePool::iterator> poolIndex;
+    mutex poolMutex;                // Guards the pool and tail page, not disk reads
+
+    void flushTail();
+    void append(const char* data, size_t length);
+    const char* cachedPage(unsigned long long number);
+    void cachePage(unsigned long long number, vector<char>& buffer);
+    void read(unsigned long long offset, char* out, size_t length);
+
+public:
+    ColdSegment(size_t pageBytes = 4096, size_t maxPoolPages = 256);
+    ~ColdSegment();
+    ColdSegment(const ColdSegment&) = delete;
+    ColdSegment& operator=(const ColdSegment&) = delete;
+
+    // Store fields and return their offset in the segment
+    unsigned long long store(const string& author, const string& category);
+    // Read fields back from the segment
+    void load(unsigned long long offset, string& author, string& category);
+    // Drop every record (space is reused, not returned to the disk)
+    void reset();
+};
+
+#endif
@@ -1,7 +1,10 @@
 /**
  * @file Library.h
- * @brief Library Management System using Multiple Data Structures
- * @details Includes: Linked List, BST, Stack, Queue, Sorting, Searching, File Storage
+ * @brief Book record, file format and search/sort algorithms
+ * @details The library itself is LibraryCore (LibraryCore.h); this header holds
+ *          what every configuration shares: Book, ListNode, the record format
+ *          of library_data.txt and the Linear/Binary Search and Bubble/Selection
+ *          Sort algorithms
  */
 
 #ifndef LIBRARY_H
@@ -32,6 +35,10 @@ struct Book {
     void display() const;
 };
 
+// Record format helpers shared by every persistence layer
+bool parseBookRecord(const string& line, Book& book);
+void writeBookRecord(ostream& out, const Book& book);
+
 /**
  * @brief Linked List Node structure
  */
@@ -41,61 +48,10 @@ struct ListNode {
     ListNode(Book b);
 };
 
-/**
- * @brief Binary Search Tree Node structure
- */
-struct TreeNode {
-    Book book;
-    TreeNode* left;
-    TreeNode* right;
-    TreeNode(Book b);
-};
-
-/**
- * @brief Library management class
- */
-class Library {
-private:
-    ListNode* head;                 // Linked List head pointer
-    TreeNode* root;                 // BST root pointer
-    stack<Book> deletedBooks;       // Stack for deleted books (LIFO)
-    queue<string> searchRequests;   // Queue for search requests (FIFO)
-    vector<Book> allBooks;          // Vector for all books
-
-    // BST helper functions
-    TreeNode* insertTree(TreeNode* node, Book book);
-    bool searchTree(TreeNode* node, string title);
-    void inOrder(TreeNode* node);
-    
-    // File system functions
-    void saveToFile();
-    void loadFromFile();
-
-public:
-    Library();
-    ~Library();
-
-    // Core operations
-    void addBook(string title, string author, string isbn, string category, int year, int copies);
-    void borrowBook(string title);
-    void returnBook(string title);
-    void deleteBook(string title);
-    void restoreBook();
-    
-    // Search algorithms
-    bool searchByTitle(string title);
-    bool linearSearch(string title);
-    bool binarySearch(string title);
-    
-    // Sorting algorithms
-    void bubbleSort();
-    void selectionSort();
-    
-    // Display functions
-    void displayAllBooks();
-    void displaySortedBooks();
-    void processSearchQueue();
-    void displayStatistics();
-};
+// Classic search and sort algorithms, run on a copy of the catalog
+bool linearSearch(const vector<Book>& books, const string& title);
+bool binarySearch(const vector<Book>& books, const string& title);
+void bubbleSort(const vector<Book>& books);
+void selectionSort(const vector<Book>& books);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,251 @@
+/**
+ * @file LibraryBenchmark.cpp
+ * @brief Compare LibraryCore instantiations on add, search, borrow/return, listing and delete
+ * @details Built as its own program (LibraryBenchmark.dev) together with Library.cpp.
+ *          Library output is discarded while timing. The sharded runs show how
+ *          borrow/return throughput scales with the number of shards. The memory
+ *          runs count live heap bytes per stored record.
+ */
+
+#include "ShardedLibrary.h"
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <new>
+using namespace std;
+
+typedef LibraryCore<ListStorage, BSTIndex, NoPersistence, NoLock> ListBSTLibrary;
+typedef LibraryCore<ArrayStorage, SortedVectorIndex, NoPersistence, NoLock> ArraySortedLibrary;
+typedef LibraryCore<ArrayStorage, NoIndex, NoPersistence, NoLock> ArrayScanLibrary;
+typedef LibraryCore<ListStorage, BSTIndex, NoPersistence, MutexLock> ListBSTMutexLibrary;
+typedef LibraryCore<ArrayStorage, SortedVectorIndex, NoPersistence, SharedMutexLock> ArraySortedSharedLibrary;
+typedef LibraryCore<TieredStorage<>, SortedVectorIndex, NoPersistence, NoLock> TieredSortedLibrary;
+typedef LibraryCore<TieredStorage<4096, 4>, SortedVectorIndex, NoPersistence, NoLock> TieredSmallPoolLibrary;
+typedef ShardedLibrary<LibraryCore<ListStorage, BSTIndex, ShardPersistence<NoPersistence>, NoLock,
+                                   DeleteHistory, NoSearchLog> > MemoryShardedLibrary;
+
+// ==================== Heap Accounting ====================
+
+static atomic<long long> heapBytes(0);  // Bytes currently allocated with new
+static const size_t heapHeader = sizeof(max_align_t);
+
+/**
+ * @brief Global operator new that records the size of every block
+ */
+void* operator new(size_t size) {
+    char* block = (char*)malloc(size + heapHeader);
+    if (!block) throw bad_alloc();
+    *(size_t*)block = size;
+    heapBytes += size;
+    return block + heapHeader;
+}
+
+/**
+ * @brief Global operator delete matching the operator new above
+ */
+void operator delete(void* pointer) noexcept {
+    if (!pointer) return;
+    char* block = (char*)pointer - heapHeader;
+    heapBytes -= *(size_t*)block;
+    free(block);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+/**
+ * @brief Stream buffer that drops everything (safe to share between threads)
+ */
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) { return c; }
+};
+
+/**
+ * @brief Milliseconds elapsed since start
+ */
+static double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Time one library configuration
+ * @param name Configuration name for the report
+ * @param titles Book titles in random order
+ * @param operations Number of searches and borrow/return pairs
+ */
+template <typename LibraryType>
+void runBenchmark(const string& name, const vector<string>& titles, int operations) {
+    NullBuffer discard;
+    streambuf* original = cout.rdbuf(&discard);
+
+    mt19937 rng(42);
+    uniform_int_distribution<size_t> pick(0, titles.size() - 1);
+    double addMs, searchMs, borrowMs, listMs, deleteMs;
+    {
+        LibraryType library("benchmark_data.txt");
+
+        auto start = chrono::steady_clock::now();
+        for (const auto& title : titles) {
+            library.addBook(title, "Author", "000000", "Category", 2000, 3);
+        }
+        addMs = elapsedMs(start);
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < operations; i++) {
+            library.searchByTitle(titles[pick(rng)]);
+        }
+        searchMs = elapsedMs(start);
+
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < operations; i++) {
+            const string& title = titles[pick(rng)];
+            library.borrowBook(title);
+            library.returnBook(title);
+        }
+        borrowMs = elapsedMs(start);
+
+        start = chrono::steady_clock::now();
+        library.displaySortedBooks();
+        listMs = elapsedMs(start);
+
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < titles.size() / 100; i++) {
+            library.deleteBook(titles[i]);
+        }
+        deleteMs = elapsedMs(start);
+    }
+
+    cout.rdbuf(original);
+    cout << name << ": add " << addMs << " ms, search " << searchMs
+         << " ms, borrow/return " << borrowMs << " ms, sorted list " << listMs
+         << " ms, delete " << deleteMs << " ms" << endl;
+}
+
+/**
+ * @brief Measure heap bytes per record for one storage policy
+ * @param name Storage name for the report
+ * @param titles Book titles (short author and category, as in most catalogs)
+ */
+template <typename StoragePolicy>
+void runMemoryBenchmark(const string& name, const vector<string>& titles) {
+    NullBuffer discard;
+    streambuf* original = cout.rdbuf(&discard);
+
+    vector<Book> books;
+    for (size_t i = 0; i < titles.size(); i++) {
+        books.push_back(Book(titles[i], "Author " + to_string(i % 1000), to_string(i),
+                             "Science", 2000, 3));
+    }
+    long long grown;
+    {
+        LibraryCore<StoragePolicy, SortedVectorIndex, NoPersistence, NoLock,
+                    NoHistory, NoSearchLog> library("benchmark_data.txt");
+        long long before = heapBytes;
+        library.addBooks(books);
+        grown = heapBytes - before;
+    }
+
+    cout.rdbuf(original);
+    cout << "Memory " << name << ": " << grown / (long long)titles.size()
+         << " bytes per record (" << grown / 1024 << " KB for " << titles.size()
+         << " books, sorted vector index included)" << endl;
+}
+
+/**
+ * @brief Time the sharded federation with several client threads
+ * @param shardCount Number of shards
+ * @param clients Number of client threads doing borrow/return
+ * @param titles Book titles in random order
+ * @param operations Total number of borrow/return pairs
+ */
+void runShardedBenchmark(size_t shardCount, int clients, const vector<string>& titles, int operations) {
+    NullBuffer discard;
+    streambuf* original = cout.rdbuf(&discard);
+
+    double addMs, borrowMs, listMs, statsMs;
+    {
+        MemoryShardedLibrary library(shardCount, "benchmark_data.txt");
+
+        auto start = chrono::steady_clock::now();
+        for (const auto& title : titles) {
+            library.addBook(title, "Author", title, "Category", 2000, 3);
+        }
+        addMs = elapsedMs(start);
+
+        start = chrono::steady_clock::now();
+        vector<thread> threads;
+        for (int c = 0; c < clients; c++) {
+            threads.push_back(thread([&library, &titles, operations, clients, c] {
+                mt19937 rng(42 + c);
+                uniform_int_distribution<size_t> pick(0, titles.size() - 1);
+                for (int i = 0; i < operations / clients; i++) {
+                    const string& title = titles[pick(rng)];
+                    library.borrowBook(title);
+                    library.returnBook(title);
+                }
+            }));
+        }
+        for (auto& client : threads) client.join();
+        borrowMs = elapsedMs(start);
+
+        start = chrono::steady_clock::now();
+        library.displaySortedBooks();
+        listMs = elapsedMs(start);
+
+        start = chrono::steady_clock::now();
+        library.displayStatistics();
+        statsMs = elapsedMs(start);
+    }
+
+    cout.rdbuf(original);
+    cout << "Sharded (" << shardCount << " shards, " << clients << " clients): add " << addMs
+         << " ms, borrow/return " << borrowMs << " ms, sorted list " << listMs
+         << " ms, statistics " << statsMs << " ms" << endl;
+}
+
+/**
+ * @brief Main function - runs every configuration on the same data
+ */
+int main(int argc, char* argv[]) {
+    int bookCount = (argc > 1) ? stoi(argv[1]) : 10000;
+    int operations = (argc > 2) ? stoi(argv[2]) : 50000;
+
+    vector<string> titles;
+    for (int i = 0; i < bookCount; i++) {
+        titles.push_back("Book " + to_string(i));
+    }
+    shuffle(titles.begin(), titles.end(), mt19937(7));
+
+    cout << "Books: " << bookCount << ", operations: " << operations << endl;
+    runMemoryBenchmark<ListStorage>("ListStorage", titles);
+    runMemoryBenchmark<ArrayStorage>("ArrayStorage", titles);
+    runMemoryBenchmark<TieredStorage<> >("TieredStorage", titles);
+    runBenchmark<ListBSTLibrary>("List + BST", titles, operations);
+    runBenchmark<ArraySortedLibrary>("Array + sorted vector", titles, operations);
+    runBenchmark<ArrayScanLibrary>("Array + no index", titles, operations);
+    runBenchmark<ListBSTMutexLibrary>("List + BST + mutex", titles, operations);
+    runBenchmark<ArraySortedSharedLibrary>("Array + sorted vector + shared mutex", titles, operations);
+    runBenchmark<TieredSortedLibrary>("Tiered + sorted vector", titles, operations);
+    runBenchmark<TieredSmallPoolLibrary>("Tiered (4-page pool) + sorted vector", titles, operations);
+
+    // One client on one shard shows the routing cost against List + BST;
+    // then shards and clients grow together up to the core count
+    size_t cores = max(1u, thread::hardware_concurrency());
+    runShardedBenchmark(1, 1, titles, operations);
+    for (size_t shardCount = 2; shardCount < cores; shardCount *= 2) {
+        runShardedBenchmark(shardCount, (int)shardCount, titles, operations);
+    }
+    if (cores > 1) runShardedBenchmark(cores, (int)cores, titles, operations);
+
+    // Shipped configurations, with file persistence (smaller run)
+    vector<string> fewTitles(titles.begin(), titles.begin() + min<size_t>(titles.size(), 500));
+    runBenchmark<KioskLibrary>("KioskLibrary", fewTitles, operations / 100);
+    runBenchmark<CirculationLibrary>("CirculationLibrary", fewTitles, operations / 100);
+    remove("benchmark_data.txt");
+    return 0;
+}
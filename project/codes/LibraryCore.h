@@ -0,0 +1,421 @@
+/**
+ * @file LibraryCore.h
+ * @brief Policy-based Library core selected at compile time
+ * @details LibraryCore<Storage, Index, Persistence, Lock, History, SearchLog>
+ *          offers the library operations used by main.cpp, but only contains
+ *          the structures chosen by its policies (see LibraryPolicies.h). Unused
+ *          indexes, file writes, locks, the restore stack and the search
+ *          queue compile away.
+ */
+
+#ifndef LIBRARY_CORE_H
+#define LIBRARY_CORE_H
+
+#include "LibraryPolicies.h"
+#include <iostream>
+#include <exception>
+using namespace std;
+
+/**
+ * @brief Counters reported by displayStatistics()
+ */
+struct LibraryStats {
+    int totalBooks;
+    int availableBooks;
+    size_t deletedBooks;
+    size_t searchRequests;
+
+    LibraryStats() : totalBooks(0), availableBooks(0), deletedBooks(0), searchRequests(0) {}
+};
+
+/**
+ * @brief Templated library management class
+ * @tparam StoragePolicy ListStorage, ArrayStorage or TieredStorage<>
+ * @tparam IndexPolicy BSTIndex, SortedVectorIndex or NoIndex (instantiated
+ *         with the storage's Record type)
+ * @tparam PersistencePolicy FilePersistence, ReadOnlyFilePersistence or NoPersistence
+ * @tparam LockPolicy NoLock, MutexLock or SharedMutexLock
+ * @tparam HistoryPolicy DeleteHistory or NoHistory
+ * @tparam SearchLogPolicy SearchLog or NoSearchLog
+ */
+template <typename StoragePolicy, template <typename> class IndexPolicy,
+          typename PersistencePolicy, typename LockPolicy,
+          typename HistoryPolicy = DeleteHistory,
+          template <typename> class SearchLogPolicy = SearchLog>
+class LibraryCore {
+private:
+    typedef lock_guard<LockPolicy> WriteGuard;
+    typedef shared_lock<LockPolicy> ReadGuard;
+    typedef typename StoragePolicy::Record Record;
+
+    StoragePolicy storage;          // Books in insertion order
+    IndexPolicy<Record> index;      // Title index over stored records
+    PersistencePolicy persistence;  // Data file handling
+    LockPolicy lock;                // Guards storage, index and history
+    HistoryPolicy history;          // Deleted books for restoreBook()
+    SearchLogPolicy<LockPolicy> searchLog;  // Search requests (locks itself)
+    bool dataLoaded;                // Persistence found existing data
+
+    void insertBook(const Book& book) {
+        index.insert(storage.add(book));
+    }
+
+    void saveChanges() {
+        if (PersistencePolicy::saveOnChange) persistence.save(storage);
+    }
+
+public:
+    typedef PersistencePolicy Persistence;
+
+    /**
+     * @brief Constructor - loads data through the persistence policy
+     * @param dataFile Data file name (ignored by NoPersistence)
+     */
+    explicit LibraryCore(const string& dataFile = "library_data.txt")
+        : persistence(dataFile), dataLoaded(false) {
+        // Bulk load: fill storage first, then build the index once
+        dataLoaded = persistence.load([this](const Book& book) { storage.add(book); });
+        index.rebuild(storage);
+        if (!dataLoaded && PersistencePolicy::seedDefaults) {
+            cout << "No previous data file found, using default data" << endl;
+            insertBook(Book("C++ Programming", "Ahmed Ali", "111111", "Programming", 2023, 5));
+            insertBook(Book("Data Structures", "Sarah Mohamed", "222222", "Programming", 2022, 3));
+            insertBook(Book("Mathematics", "Dr. Sami", "333333", "Science", 2021, 2));
+            saveChanges();
+        }
+    }
+
+    /**
+     * @brief Destructor - saves data through the persistence policy
+     * @details Storage errors (e.g. a failed cold segment read) are reported
+     *          here instead of escaping the destructor
+     */
+    ~LibraryCore() {
+        try {
+            saveChanges();
+        } catch (const exception& error) {
+            cout << "Error saving data: " << error.what() << endl;
+        }
+    }
+
+    LibraryCore(const LibraryCore&) = delete;
+    LibraryCore& operator=(const LibraryCore&) = delete;
+
+    // ==================== Book Management ====================
+
+    /**
+     * @brief Add new book to storage and index
+     */
+    void addBook(string title, string author, string isbn, string category, int year, int copies) {
+        WriteGuard guard(lock);
+        insertBook(Book(title, author, isbn, category, year, copies));
+        saveChanges();
+        cout << "Book added: " << title << endl;
+    }
+
+    /**
+     * @brief Borrow the first copy with this title that is still available
+     * @return true if borrowed, false otherwise
+     */
+    bool borrowBook(string title) {
+        WriteGuard guard(lock);
+        Record* book = index.findMatch(storage, title, [](const Record& b) { return b.availableCopies > 0; });
+        if (book) {
+            book->availableCopies--;
+            if (book->availableCopies == 0) {
+                book->isAvailable = false;
+            }
+            saveChanges();
+            cout << "Book borrowed: " << title << endl;
+            return true;
+        }
+        cout << "Book not available: " << title << endl;
+        return false;
+    }
+
+    /**
+     * @brief Return a book found through the index
+     * @return true if returned, false otherwise
+     */
+    bool returnBook(string title) {
+        WriteGuard guard(lock);
+        Record* book = index.find(storage, title);
+        if (book) {
+            book->availableCopies++;
+            book->isAvailable = true;
+            saveChanges();
+            cout << "Book returned: " << title << endl;
+            return true;
+        }
+        cout << "Book not found: " << title << endl;
+        return false;
+    }
+
+    /**
+     * @brief Delete a book and push it on the restore stack
+     * @return true if deleted, false otherwise
+     */
+    bool deleteBook(string title) {
+        WriteGuard guard(lock);
+        if (storage.size() == 0) {
+            cout << "Library is empty!" << endl;
+            return false;
+        }
+        Record* book = index.find(storage, title);
+        if (!book) {
+            cout << "Book not found: " << title << endl;
+            return false;
+        }
+        // Full record (cold fields included) only when it is kept for restore
+        if (HistoryPolicy::keepsBooks) history.push(storage.describe(*book));
+        if (StoragePolicy::stableOnErase) {
+            index.erase(book);
+            storage.remove(book);
+        } else {
+            storage.remove(book);
+            index.rebuild(storage);
+        }
+        saveChanges();
+        cout << "Book deleted: " << title << endl;
+        return true;
+    }
+
+    /**
+     * @brief Restore last deleted book
+     * @return true if a book was restored, false otherwise
+     */
+    bool restoreBook() {
+        string restoredTitle;
+        return restoreBook(restoredTitle);
+    }
+
+    /**
+     * @brief Restore last deleted book
+     * @param restoredTitle Title of the restored book
+     * @return true if a book was restored, false otherwise
+     */
+    bool restoreBook(string& restoredTitle) {
+        Book restoredBook;
+        {
+            WriteGuard guard(lock);
+            if (!history.pop(restoredBook)) {
+                cout << "No deleted books to restore" << endl;
+                return false;
+            }
+        }
+        addBook(restoredBook.title, restoredBook.author, restoredBook.isbn,
+                restoredBook.category, restoredBook.year, restoredBook.totalCopies);
+        cout << "Book restored: " << restoredBook.title << endl;
+        restoredTitle = restoredBook.title;
+        return true;
+    }
+
+    /**
+     * @brief Add many books with a single save (used for bulk import)
+     * @param books Books to add
+     */
+    void addBooks(const vector<Book>& books) {
+        WriteGuard guard(lock);
+        for (const auto& book : books) storage.add(book);
+        index.rebuild(storage);
+        saveChanges();
+    }
+
+    // ==================== Search ====================
+
+    /**
+     * @brief Search by title through the index and record the request
+     * @return true if found, false otherwise
+     */
+    bool searchByTitle(string title) {
+        searchLog.push(title);
+        bool found = hasTitle(title);
+        cout << (found ? "Book found: " : "Book not found: ") << title << endl;
+        return found;
+    }
+
+    /**
+     * @brief Search by author (reads descriptive fields through the storage)
+     * @return true if at least one book was found, false otherwise
+     */
+    bool searchByAuthor(string author) {
+        vector<Book> found = booksByAuthor(author);
+        if (found.empty()) {
+            cout << "No books by: " << author << endl;
+            return false;
+        }
+        cout << "Books by " << author << ":" << endl;
+        for (const auto& book : found) book.display();
+        return true;
+    }
+
+    /**
+     * @brief Process all search requests in queue
+     */
+    void processSearchQueue() {
+        queue<string> pending = searchLog.takeAll();
+        if (pending.empty()) {
+            cout << "No search requests" << endl;
+            return;
+        }
+        cout << "Processing Search Queue:" << endl;
+        while (!pending.empty()) {
+            string title = pending.front();
+            pending.pop();
+            bool found = hasTitle(title);
+            cout << (found ? "Book found: " : "Book not found: ") << title << endl;
+        }
+    }
+
+    // ==================== Data Display ====================
+
+    /**
+     * @brief Display all books in insertion order
+     */
+    void displayAllBooks() {
+        ReadGuard guard(lock);
+        if (storage.size() == 0) {
+            cout << "No books in library" << endl;
+            return;
+        }
+        cout << "All Books:" << endl;
+        storage.forEach([this](const Record& book) { storage.describe(book).display(); });
+    }
+
+    /**
+     * @brief Display books sorted by title through the index
+     */
+    void displaySortedBooks() {
+        ReadGuard guard(lock);
+        if (storage.size() == 0) {
+            cout << "No books in library" << endl;
+            return;
+        }
+        cout << "Books Sorted by Title:" << endl;
+        index.forEachSorted(storage, [this](const Record& book) { storage.describe(book).display(); });
+    }
+
+    /**
+     * @brief Display library statistics
+     */
+    void displayStatistics() {
+        LibraryStats stats = statistics();
+        cout << "Library Statistics:" << endl;
+        cout << "Total Books: " << stats.totalBooks << endl;
+        cout << "Available Books: " << stats.availableBooks << endl;
+        cout << "Deleted Books: " << stats.deletedBooks << endl;
+        cout << "Search Requests: " << stats.searchRequests << endl;
+    }
+
+    // ==================== Queries (no output) ====================
+
+    /**
+     * @brief Check whether a title exists, without recording the request
+     */
+    bool hasTitle(const string& title) {
+        ReadGuard guard(lock);
+        return index.find(storage, title) != nullptr;
+    }
+
+    /**
+     * @brief Check whether some copy of a title can still be borrowed
+     */
+    bool hasAvailableCopy(const string& title) {
+        ReadGuard guard(lock);
+        return index.findMatch(storage, title, [](const Record& b) { return b.availableCopies > 0; }) != nullptr;
+    }
+
+    /**
+     * @brief Whether existing data was loaded when the library was created
+     * @details false on a first run (no data file) and for NoPersistence
+     */
+    bool loadedFromFile() const {
+        return dataLoaded;
+    }
+
+    /**
+     * @brief Titles of all books in insertion order
+     */
+    vector<string> titles() {
+        ReadGuard guard(lock);
+        vector<string> result;
+        storage.forEach([&](const Record& book) { result.push_back(book.title); });
+        return result;
+    }
+
+    /**
+     * @brief Full records of all books in insertion order
+     */
+    vector<Book> allBooks() {
+        ReadGuard guard(lock);
+        vector<Book> result;
+        storage.forEach([&](const Record& book) { result.push_back(storage.describe(book)); });
+        return result;
+    }
+
+    /**
+     * @brief Full records of all books sorted by title
+     */
+    vector<Book> sortedBooks() {
+        ReadGuard guard(lock);
+        vector<Book> result;
+        index.forEachSorted(storage, [&](const Record& book) { result.push_back(storage.describe(book)); });
+        return result;
+    }
+
+    /**
+     * @brief Full records of all books by an author
+     */
+    vector<Book> booksByAuthor(const string& author) {
+        ReadGuard guard(lock);
+        vector<Book> result;
+        storage.forEach([&](const Record& book) {
+            Book full = storage.describe(book);
+            if (full.author == author) result.push_back(full);
+        });
+        return result;
+    }
+
+    /**
+     * @brief Count books, available books, deleted books and search requests
+     */
+    LibraryStats statistics() {
+        LibraryStats stats;
+        {
+            ReadGuard guard(lock);
+            storage.forEach([&](const Record& book) {
+                stats.totalBooks++;
+                if (book.isAvailable) stats.availableBooks++;
+            });
+            stats.deletedBooks = history.size();
+        }
+        stats.searchRequests = searchLog.size();
+        return stats;
+    }
+};
+
+// ==================== Ready-made Configurations ====================
+
+/**
+ * @brief Read-mostly kiosk: array storage, binary-searched index,
+ *        shared reader lock, data file is never rewritten, no restore stack
+ */
+typedef LibraryCore<ArrayStorage, SortedVectorIndex,
+                    ReadOnlyFilePersistence, SharedMutexLock, NoHistory> KioskLibrary;
+
+/**
+ * @brief Write-heavy circulation desk: linked list storage, BST index,
+ *        every change saved to file under one mutex (used by main.cpp)
+ */
+typedef LibraryCore<ListStorage, BSTIndex,
+                    FilePersistence, MutexLock> CirculationLibrary;
+
+/**
+ * @brief Large read-mostly union catalog: hot/cold tiered storage,
+ *        binary-searched index, shared reader lock, read-only data file,
+ *        no restore stack
+ */
+typedef LibraryCore<TieredStorage<>, SortedVectorIndex,
+                    ReadOnlyFilePersistence, SharedMutexLock, NoHistory> UnionCatalogLibrary;
+
+#endif
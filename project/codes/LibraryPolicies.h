@@ -0,0 +1,717 @@
+/**
+ * @file LibraryPolicies.h
+ * @brief Storage, index, persistence, locking, history and search log policies for LibraryCore
+ * @details Every policy is a small class picked at compile time, so a library
+ *          configuration only contains the structures it actually uses
+ */
+
+#ifndef LIBRARY_POLICIES_H
+#define LIBRARY_POLICIES_H
+
+#include "Library.h"
+#include "ColdSegment.h"
+#include <deque>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <iostream>
+using namespace std;
+
+// ==================== Storage Policies ====================
+
+/**
+ * @brief Linked list storage (cheap insert and delete)
+ * @details Keeps a tail pointer so adding a book does not walk the list.
+ *          Node addresses never move, so an index can be updated in place.
+ */
+class ListStorage {
+private:
+    ListNode* head;
+    ListNode* tail;
+    size_t count;
+
+public:
+    typedef Book Record;
+    static const bool stableOnErase = true;
+
+    ListStorage() : head(nullptr), tail(nullptr), count(0) {}
+    ~ListStorage() { clear(); }
+    ListStorage(const ListStorage&) = delete;
+    ListStorage& operator=(const ListStorage&) = delete;
+
+    /**
+     * @brief Append book at the end of the list
+     * @return Address of the stored book
+     */
+    Book* add(const Book& book) {
+        ListNode* newNode = new ListNode(book);
+        if (!head) {
+            head = newNode;
+        } else {
+            tail->next = newNode;
+        }
+        tail = newNode;
+        count++;
+        return &newNode->book;
+    }
+
+    /**
+     * @brief Linear search by title
+     * @return First book with this title, nullptr if not found
+     */
+    Book* find(const string& title) {
+        for (ListNode* current = head; current; current = current->next) {
+            if (current->book.title == title) return &current->book;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Unlink the node that stores the given book
+     * @param target Address returned by add() or find()
+     * @return true if removed, false otherwise
+     */
+    bool remove(const Book* target) {
+        ListNode* prev = nullptr;
+        for (ListNode* current = head; current; prev = current, current = current->next) {
+            if (&current->book == target) {
+                if (prev) {
+                    prev->next = current->next;
+                } else {
+                    head = current->next;
+                }
+                if (tail == current) tail = prev;
+                delete current;
+                count--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename Visitor>
+    void forEach(Visitor visit) {
+        for (ListNode* current = head; current; current = current->next) {
+            visit(current->book);
+        }
+    }
+
+    size_t size() const { return count; }
+
+    /**
+     * @brief Full book record (all fields are already in memory)
+     */
+    const Book& describe(const Book& book) const { return book; }
+
+    void clear() {
+        while (head) {
+            ListNode* temp = head;
+            head = head->next;
+            delete temp;
+        }
+        tail = nullptr;
+        count = 0;
+    }
+};
+
+/**
+ * @brief Array storage (fast scans, no per-book allocation)
+ * @details Books are kept in a std::deque: fixed-size blocks of consecutive
+ *          books, not one contiguous array. Appending keeps addresses stable,
+ *          erasing does not, so the index is rebuilt after a delete.
+ */
+class ArrayStorage {
+private:
+    deque<Book> books;
+
+public:
+    typedef Book Record;
+    static const bool stableOnErase = false;
+
+    Book* add(const Book& book) {
+        books.push_back(book);
+        return &books.back();
+    }
+
+    Book* find(const string& title) {
+        for (auto& book : books) {
+            if (book.title == title) return &book;
+        }
+        return nullptr;
+    }
+
+    bool remove(const Book* target) {
+        for (auto it = books.begin(); it != books.end(); ++it) {
+            if (&*it == target) {
+                books.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename Visitor>
+    void forEach(Visitor visit) {
+        for (auto& book : books) visit(book);
+    }
+
+    size_t size() const { return books.size(); }
+    void clear() { books.clear(); }
+
+    /**
+     * @brief Full book record (all fields are already in memory)
+     */
+    const Book& describe(const Book& book) const { return book; }
+};
+
+/**
+ * @brief In-memory part of a tiered book: keys and circulation fields only
+ * @details Unlike Book it has no author/category members, so each record
+ *          is smaller even when those strings are short enough to be
+ *          stored inline
+ */
+struct HotBook {
+    string title;
+    string isbn;
+    unsigned long long coldOffset;  // Author/category record in the segment
+    int year;
+    int totalCopies;
+    int availableCopies;
+    bool isAvailable;
+    bool isFree;                    // Slot of a deleted book, reused by add()
+};
+
+/**
+ * @brief Hot/cold tiered storage for catalogs larger than RAM
+ * @details HotBook records stay in a dense in-memory table; author and
+ *          category live in a ColdSegment and are only read through its
+ *          buffer pool when describe() builds a full Book.
+ *          Deleting a book only marks its slot free and the next add()
+ *          reuses it, so records never move and the index is updated for
+ *          that one book instead of being rebuilt. Books are visited in
+ *          slot order, so a new book can take a deleted book's place.
+ *          The segment is append-only: deleting a book does not free its
+ *          cold record, and restoring it stores a new one. clear() starts
+ *          the segment over.
+ * @tparam PageSize Bytes per segment page
+ * @tparam PoolPages Maximum segment pages cached in memory
+ */
+template <size_t PageSize = 4096, size_t PoolPages = 256>
+class TieredStorage {
+private:
+    deque<HotBook> books;           // Slots (deque: appending keeps addresses)
+    vector<HotBook*> freeSlots;     // Slots of deleted books
+    ColdSegment segment;
+
+public:
+    typedef HotBook Record;
+    static const bool stableOnErase = true;
+
+    TieredStorage() : segment(PageSize, PoolPages) {}
+
+    /**
+     * @brief Move cold fields to the segment and keep the rest in memory
+     * @return Address of the stored (hot) record
+     */
+    HotBook* add(const Book& book) {
+        unsigned long long coldOffset = segment.store(book.author, book.category);
+        HotBook* hot;
+        if (freeSlots.empty()) {
+            books.push_back(HotBook());
+            hot = &books.back();
+        } else {
+            hot = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        hot->title = book.title;
+        hot->isbn = book.isbn;
+        hot->coldOffset = coldOffset;
+        hot->year = book.year;
+        hot->totalCopies = book.totalCopies;
+        hot->availableCopies = book.availableCopies;
+        hot->isAvailable = book.isAvailable;
+        hot->isFree = false;
+        return hot;
+    }
+
+    HotBook* find(const string& title) {
+        for (auto& book : books) {
+            if (!book.isFree && book.title == title) return &book;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Free the slot of a book without moving any other record
+     * @param target Address returned by add() or find()
+     * @return true if removed, false if the slot was already free
+     */
+    bool remove(const HotBook* target) {
+        if (target->isFree) return false;
+        HotBook* slot = const_cast<HotBook*>(target);
+        string().swap(slot->title);
+        string().swap(slot->isbn);
+        slot->isFree = true;
+        freeSlots.push_back(slot);
+        return true;
+    }
+
+    template <typename Visitor>
+    void forEach(Visitor visit) {
+        for (auto& book : books) {
+            if (!book.isFree) visit(book);
+        }
+    }
+
+    size_t size() const { return books.size() - freeSlots.size(); }
+
+    void clear() {
+        books.clear();
+        freeSlots.clear();
+        segment.reset();
+    }
+
+    /**
+     * @brief Full book with author and category loaded from the segment
+     * @param hot Record returned by add(), find() or forEach()
+     */
+    Book describe(const HotBook& hot) {
+        Book full(hot.title, "", hot.isbn, "", hot.year, hot.totalCopies);
+        full.availableCopies = hot.availableCopies;
+        full.isAvailable = hot.isAvailable;
+        segment.load(hot.coldOffset, full.author, full.category);
+        return full;
+    }
+};
+
+// ==================== Title Index Policies ====================
+
+/**
+ * @brief No title index - lookups scan the storage, listings sort on demand
+ * @tparam Record Record type of the storage policy (Book or HotBook)
+ */
+template <typename Record>
+class NoIndex {
+public:
+    void insert(Record*) {}
+    void erase(const Record*) {}
+    void clear() {}
+
+    template <typename Storage>
+    void rebuild(Storage&) {}
+
+    template <typename Storage>
+    Record* find(Storage& storage, const string& title) {
+        return storage.find(title);
+    }
+
+    /**
+     * @brief First book (insertion order) with this title that passes a test
+     */
+    template <typename Storage, typename Test>
+    Record* findMatch(Storage& storage, const string& title, Test test) {
+        Record* match = nullptr;
+        storage.forEach([&](Record& book) {
+            if (!match && book.title == title && test(book)) match = &book;
+        });
+        return match;
+    }
+
+    template <typename Storage, typename Visitor>
+    void forEachSorted(Storage& storage, Visitor visit) {
+        vector<Record*> sorted;
+        storage.forEach([&](Record& book) { sorted.push_back(&book); });
+        stable_sort(sorted.begin(), sorted.end(),
+                    [](const Record* a, const Record* b) { return a->title < b->title; });
+        for (Record* book : sorted) visit(*book);
+    }
+};
+
+/**
+ * @brief Binary Search Tree over book addresses (cheap insert and delete)
+ * @details Equal titles go to the right, so they stay in insertion order
+ * @tparam Record Record type of the storage policy (Book or HotBook)
+ */
+template <typename Record>
+class BSTIndex {
+private:
+    struct IndexNode {
+        Record* book;
+        IndexNode* left;
+        IndexNode* right;
+        IndexNode(Record* b) : book(b), left(nullptr), right(nullptr) {}
+    };
+    IndexNode* root;
+
+    static void destroy(IndexNode* node) {
+        if (node) {
+            destroy(node->left);
+            destroy(node->right);
+            delete node;
+        }
+    }
+
+    static IndexNode* eraseNode(IndexNode* node, const Record* target) {
+        if (!node) return nullptr;
+        if (node->book != target) {
+            if (target->title < node->book->title) {
+                node->left = eraseNode(node->left, target);
+            } else {
+                node->right = eraseNode(node->right, target);
+            }
+            return node;
+        }
+        if (!node->left || !node->right) {
+            IndexNode* child = node->left ? node->left : node->right;
+            delete node;
+            return child;
+        }
+        // Two children: take the in-order successor's book
+        IndexNode* successor = node->right;
+        while (successor->left) successor = successor->left;
+        node->book = successor->book;
+        node->right = eraseNode(node->right, successor->book);
+        return node;
+    }
+
+    template <typename Visitor>
+    static void inOrder(IndexNode* node, Visitor& visit) {
+        if (node) {
+            inOrder(node->left, visit);
+            visit(*node->book);
+            inOrder(node->right, visit);
+        }
+    }
+
+public:
+    BSTIndex() : root(nullptr) {}
+    ~BSTIndex() { destroy(root); }
+    BSTIndex(const BSTIndex&) = delete;
+    BSTIndex& operator=(const BSTIndex&) = delete;
+
+    void insert(Record* book) {
+        IndexNode** link = &root;
+        while (*link) {
+            link = (book->title < (*link)->book->title) ? &(*link)->left : &(*link)->right;
+        }
+        *link = new IndexNode(book);
+    }
+
+    void erase(const Record* book) { root = eraseNode(root, book); }
+
+    void clear() {
+        destroy(root);
+        root = nullptr;
+    }
+
+    template <typename Storage>
+    void rebuild(Storage& storage) {
+        clear();
+        storage.forEach([this](Record& book) { insert(&book); });
+    }
+
+    template <typename Storage>
+    Record* find(Storage&, const string& title) {
+        IndexNode* node = root;
+        while (node) {
+            if (node->book->title == title) return node->book;
+            node = (title < node->book->title) ? node->left : node->right;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief First book with this title that passes a test
+     * @details Equal titles always sit in the right subtree of an equal
+     *          node, so the search simply continues to the right
+     */
+    template <typename Storage, typename Test>
+    Record* findMatch(Storage&, const string& title, Test test) {
+        IndexNode* node = root;
+        while (node) {
+            if (node->book->title == title && test(*node->book)) return node->book;
+            node = (title < node->book->title) ? node->left : node->right;
+        }
+        return nullptr;
+    }
+
+    template <typename Storage, typename Visitor>
+    void forEachSorted(Storage&, Visitor visit) {
+        inOrder(root, visit);
+    }
+};
+
+/**
+ * @brief Sorted array of book addresses (fast binary search, slow insert)
+ * @details Best for read-mostly catalogs where books are rarely added
+ * @tparam Record Record type of the storage policy (Book or HotBook)
+ */
+template <typename Record>
+class SortedVectorIndex {
+private:
+    vector<Record*> sorted;
+
+    static bool titleLess(const Record* a, const Record* b) { return a->title < b->title; }
+
+public:
+    void insert(Record* book) {
+        sorted.insert(upper_bound(sorted.begin(), sorted.end(), book, titleLess), book);
+    }
+
+    void erase(const Record* book) {
+        auto range = equal_range(sorted.begin(), sorted.end(), const_cast<Record*>(book), titleLess);
+        auto it = std::find(range.first, range.second, book);
+        if (it != range.second) sorted.erase(it);
+    }
+
+    void clear() { sorted.clear(); }
+
+    template <typename Storage>
+    void rebuild(Storage& storage) {
+        sorted.clear();
+        storage.forEach([this](Record& book) { sorted.push_back(&book); });
+        stable_sort(sorted.begin(), sorted.end(), titleLess);
+    }
+
+    template <typename Storage>
+    Record* find(Storage&, const string& title) {
+        auto it = lower_bound(sorted.begin(), sorted.end(), title,
+                              [](const Record* book, const string& t) { return book->title < t; });
+        if (it != sorted.end() && (*it)->title == title) return *it;
+        return nullptr;
+    }
+
+    /**
+     * @brief First book with this title that passes a test
+     */
+    template <typename Storage, typename Test>
+    Record* findMatch(Storage&, const string& title, Test test) {
+        auto it = lower_bound(sorted.begin(), sorted.end(), title,
+                              [](const Record* book, const string& t) { return book->title < t; });
+        for (; it != sorted.end() && (*it)->title == title; ++it) {
+            if (test(**it)) return *it;
+        }
+        return nullptr;
+    }
+
+    template <typename Storage, typename Visitor>
+    void forEachSorted(Storage&, Visitor visit) {
+        for (Record* book : sorted) visit(*book);
+    }
+};
+
+// ==================== Persistence Policies ====================
+
+/**
+ * @brief Load from and save to a text file (library_data.txt format)
+ */
+class FilePersistence {
+protected:
+    string fileName;
+
+public:
+    static const bool saveOnChange = true;
+    static const bool seedDefaults = true;
+
+    explicit FilePersistence(const string& file) : fileName(file) {}
+
+    /**
+     * @brief Read every record and hand it to the library
+     * @return false if the file does not exist
+     */
+    template <typename Loader>
+    bool load(Loader addLoaded) {
+        ifstream file(fileName);
+        if (!file.is_open()) return false;
+
+        int bookCount;
+        file >> bookCount;
+        file.ignore(); // Ignore the number line
+
+        for (int i = 0; i < bookCount; i++) {
+            string line;
+            getline(file, line);
+            Book book;
+            if (parseBookRecord(line, book)) addLoaded(book);
+        }
+        cout << "Loaded " << bookCount << " books from file" << endl;
+        return true;
+    }
+
+    template <typename Storage>
+    void save(Storage& storage) {
+        ofstream file(fileName);
+        if (!file.is_open()) {
+            cout << "Error opening file for writing!" << endl;
+            return;
+        }
+        file << storage.size() << endl;
+        storage.forEach([&](const typename Storage::Record& book) { writeBookRecord(file, storage.describe(book)); });
+        cout << "Data saved to file successfully" << endl;
+    }
+};
+
+/**
+ * @brief Load from a text file but never write it back (kiosk terminals)
+ */
+class ReadOnlyFilePersistence : public FilePersistence {
+public:
+    static const bool saveOnChange = false;
+
+    explicit ReadOnlyFilePersistence(const string& file) : FilePersistence(file) {}
+
+    template <typename Storage>
+    void save(Storage&) {}
+};
+
+/**
+ * @brief Keep everything in memory only
+ */
+class NoPersistence {
+public:
+    static const bool saveOnChange = false;
+    static const bool seedDefaults = true;
+
+    explicit NoPersistence(const string&) {}
+
+    template <typename Loader>
+    bool load(Loader) { return false; }
+
+    template <typename Storage>
+    void save(Storage&) {}
+};
+
+/**
+ * @brief Shard wrapper - an empty shard stays empty instead of
+ *        receiving the default books
+ * @tparam BasePersistence Any persistence policy above
+ */
+template <typename BasePersistence>
+class ShardPersistence : public BasePersistence {
+public:
+    static const bool seedDefaults = false;
+
+    explicit ShardPersistence(const string& file) : BasePersistence(file) {}
+};
+
+// ==================== Locking Policies ====================
+
+/**
+ * @brief No synchronization (single-threaded use)
+ */
+class NoLock {
+public:
+    void lock() {}
+    void unlock() {}
+    void lock_shared() {}
+    void unlock_shared() {}
+};
+
+/**
+ * @brief One mutex for readers and writers (write-heavy use)
+ */
+class MutexLock {
+private:
+    mutex m;
+
+public:
+    void lock() { m.lock(); }
+    void unlock() { m.unlock(); }
+    void lock_shared() { m.lock(); }
+    void unlock_shared() { m.unlock(); }
+};
+
+/**
+ * @brief Readers share the lock, writers take it alone (read-mostly use)
+ */
+class SharedMutexLock {
+private:
+    shared_timed_mutex m;
+
+public:
+    void lock() { m.lock(); }
+    void unlock() { m.unlock(); }
+    void lock_shared() { m.lock_shared(); }
+    void unlock_shared() { m.unlock_shared(); }
+};
+
+// ==================== History and Search Log Policies ====================
+
+/**
+ * @brief Stack of deleted books so restoreBook() can undo a delete (LIFO)
+ */
+class DeleteHistory {
+private:
+    stack<Book> books;
+
+public:
+    static const bool keepsBooks = true;
+
+    void push(const Book& book) { books.push(book); }
+
+    bool pop(Book& book) {
+        if (books.empty()) return false;
+        book = books.top();
+        books.pop();
+        return true;
+    }
+
+    size_t size() const { return books.size(); }
+};
+
+/**
+ * @brief No undo - deleted books are gone (kiosks, catalogs)
+ */
+class NoHistory {
+public:
+    static const bool keepsBooks = false;
+
+    void push(const Book&) {}
+    bool pop(Book&) { return false; }
+    size_t size() const { return 0; }
+};
+
+/**
+ * @brief Queue of search requests (FIFO) with its own lock
+ * @tparam LockPolicy Lock used by the library
+ */
+template <typename LockPolicy>
+class SearchLog {
+private:
+    LockPolicy lock;
+    queue<string> requests;
+
+public:
+    void push(const string& title) {
+        lock_guard<LockPolicy> guard(lock);
+        requests.push(title);
+    }
+
+    /**
+     * @brief Remove and return every queued request
+     */
+    queue<string> takeAll() {
+        queue<string> pending;
+        lock_guard<LockPolicy> guard(lock);
+        swap(pending, requests);
+        return pending;
+    }
+
+    size_t size() {
+        lock_guard<LockPolicy> guard(lock);
+        return requests.size();
+    }
+};
+
+/**
+ * @brief Search requests are not recorded
+ */
+template <typename LockPolicy>
+class NoSearchLog {
+public:
+    void push(const string&) {}
+    queue<string> takeAll() { return queue<string>(); }
+    size_t size() { return 0; }
+};
+
+#endif
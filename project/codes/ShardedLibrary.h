@@ -0,0 +1,579 @@
+/**
+ * @file ShardedLibrary.h
+ * @brief Multi-branch catalog split into shards by ISBN hash
+ * @details Every shard is a LibraryCore guarded by its own mutex and served
+ *          by one worker thread. Point operations run on the caller's thread
+ *          under the owning shard's mutex, so requests for different shards
+ *          run in parallel without a thread hand-off or allocation. Searches,
+ *          listings and statistics are queued to every shard's worker in
+ *          parallel and their results merged (scatter-gather).
+ */
+
+#ifndef SHARDED_LIBRARY_H
+#define SHARDED_LIBRARY_H
+
+#include "LibraryCore.h"
+#include <thread>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <cstdio>
+using namespace std;
+
+/**
+ * @brief Worker thread that runs tasks from a FIFO queue one at a time
+ */
+class ShardWorker {
+private:
+    mutex taskMutex;
+    condition_variable taskReady;
+    queue<function<void()> > tasks;  // Pending tasks (FIFO)
+    bool stopping;
+    thread worker;
+
+    void run() {
+        while (true) {
+            function<void()> task;
+            {
+                unique_lock<mutex> guard(taskMutex);
+                taskReady.wait(guard, [this] { return stopping || !tasks.empty(); });
+                if (tasks.empty()) return;
+                task = move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+
+public:
+    ShardWorker() : stopping(false), worker(&ShardWorker::run, this) {}
+
+    /**
+     * @brief Finish queued tasks, then stop the thread
+     */
+    ~ShardWorker() {
+        {
+            lock_guard<mutex> guard(taskMutex);
+            stopping = true;
+        }
+        taskReady.notify_one();
+        worker.join();
+    }
+
+    ShardWorker(const ShardWorker&) = delete;
+    ShardWorker& operator=(const ShardWorker&) = delete;
+
+    /**
+     * @brief Queue a task for the worker thread
+     * @return Future holding the task result
+     */
+    template <typename Task>
+    auto submit(Task&& task) -> future<decltype(task())> {
+        typedef decltype(task()) Result;
+        auto packaged = make_shared<packaged_task<Result()> >(forward<Task>(task));
+        future<Result> result = packaged->get_future();
+        {
+            lock_guard<mutex> guard(taskMutex);
+            tasks.push([packaged] { (*packaged)(); });
+        }
+        taskReady.notify_one();
+        return result;
+    }
+};
+
+/**
+ * @brief Federation of LibraryCore shards partitioned by ISBN hash
+ * @details Books are placed by an FNV-1a hash of the ISBN, so the layout
+ *          does not depend on the standard library. When shards save to
+ *          files, the shard count is kept in library_data_shards.txt; opening
+ *          with a different count splits the old shard files again.
+ * @tparam ShardLibrary LibraryCore used for every shard; its persistence
+ *         policy should be a ShardPersistence so empty shards stay empty.
+ *         Shards need no search log: the federation keeps its own.
+ */
+template <typename ShardLibrary =
+              LibraryCore<ListStorage, BSTIndex, ShardPersistence<FilePersistence>, NoLock,
+                          DeleteHistory, NoSearchLog> >
+class ShardedLibrary {
+private:
+    struct Shard {
+        mutex lock;                 // Held for every operation on library
+        unique_ptr<ShardLibrary> library;
+        ShardWorker worker;         // Declared last: stopped before library is destroyed
+    };
+
+    /**
+     * @brief One part of the title directory (titles are spread by hash)
+     */
+    struct DirectoryStripe {
+        shared_timed_mutex lock;
+        unordered_map<string, vector<size_t> > titleShards;  // Owning shard per copy
+    };
+
+    static const size_t directoryStripes = 64;
+
+    vector<unique_ptr<Shard> > shards;
+    DirectoryStripe directory[directoryStripes];  // Title directory
+    stack<size_t> deletedShards;                  // Shard of each deleted book (LIFO)
+    queue<string> searchRequests;                 // Queue for search requests (FIFO)
+    mutex historyLock;                            // Guards deletedShards
+    mutex queueLock;                              // Guards searchRequests
+
+    // Shard files are only written (and the layout kept) when shards save
+    static const bool keepsLayout = ShardLibrary::Persistence::saveOnChange;
+
+    /**
+     * @brief File next to the data file, e.g. library_data_shard2.txt
+     */
+    static string companionFileName(const string& dataFile, const string& suffix) {
+        size_t dot = dataFile.rfind('.');
+        string base = (dot == string::npos) ? dataFile : dataFile.substr(0, dot);
+        string extension = (dot == string::npos) ? "" : dataFile.substr(dot);
+        return base + suffix + extension;
+    }
+
+    static string shardFileName(const string& dataFile, size_t shard) {
+        return companionFileName(dataFile, "_shard" + to_string(shard));
+    }
+
+    /**
+     * @brief Shard count written by the last run, 0 if there is none
+     */
+    static size_t readLayout(const string& dataFile) {
+        ifstream file(companionFileName(dataFile, "_shards"));
+        size_t count = 0;
+        if (!file.is_open() || !(file >> count)) return 0;
+        return count;
+    }
+
+    static void writeLayout(const string& dataFile, size_t count) {
+        ofstream file(companionFileName(dataFile, "_shards"));
+        if (!file.is_open()) {
+            cout << "Error opening file for writing!" << endl;
+            return;
+        }
+        file << count << endl;
+    }
+
+    /**
+     * @brief 64-bit FNV-1a hash (same value with every compiler)
+     */
+    static unsigned long long fnv1a(const string& key) {
+        unsigned long long hash = 14695981039346656037ULL;
+        for (unsigned char c : key) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    static size_t shardOf(const string& isbn, size_t count) {
+        return fnv1a(isbn) % count;
+    }
+
+    /**
+     * @brief Run a query on one shard from the calling thread
+     */
+    template <typename Query>
+    auto onShard(size_t shard, Query query) -> decltype(query(declval<ShardLibrary&>())) {
+        lock_guard<mutex> guard(shards[shard]->lock);
+        return query(*shards[shard]->library);
+    }
+
+    /**
+     * @brief Run a query on every shard in parallel and collect the results
+     * @return One result per shard, in shard order
+     */
+    template <typename Query>
+    auto scatter(Query query) -> vector<decltype(query(declval<ShardLibrary&>()))> {
+        typedef decltype(query(declval<ShardLibrary&>())) Result;
+        vector<future<Result> > pending;
+        for (auto& shard : shards) {
+            Shard* target = shard.get();
+            pending.push_back(shard->worker.submit([target, query] {
+                lock_guard<mutex> guard(target->lock);
+                return query(*target->library);
+            }));
+        }
+        vector<Result> results;
+        for (auto& result : pending) results.push_back(result.get());
+        return results;
+    }
+
+    DirectoryStripe& stripeOf(const string& title) {
+        return directory[fnv1a(title) % directoryStripes];
+    }
+
+    /**
+     * @brief One shard that owns a copy of a title, from the directory
+     * @param rank Which owner (0 for the first)
+     * @param shard Owning shard
+     * @return false if the title has no owner with this rank
+     */
+    bool route(const string& title, size_t rank, size_t& shard) {
+        DirectoryStripe& stripe = stripeOf(title);
+        shared_lock<shared_timed_mutex> guard(stripe.lock);
+        auto found = stripe.titleShards.find(title);
+        if (found == stripe.titleShards.end() || rank >= found->second.size()) return false;
+        shard = found->second[rank];
+        return true;
+    }
+
+    void recordTitle(const string& title, size_t shard) {
+        DirectoryStripe& stripe = stripeOf(title);
+        unique_lock<shared_timed_mutex> guard(stripe.lock);
+        stripe.titleShards[title].push_back(shard);
+    }
+
+    void forgetTitle(const string& title, size_t shard) {
+        DirectoryStripe& stripe = stripeOf(title);
+        unique_lock<shared_timed_mutex> guard(stripe.lock);
+        auto found = stripe.titleShards.find(title);
+        if (found == stripe.titleShards.end()) return;
+        vector<size_t>& owners = found->second;
+        auto owner = find(owners.begin(), owners.end(), shard);
+        if (owner != owners.end()) owners.erase(owner);
+        if (owners.empty()) stripe.titleShards.erase(found);
+    }
+
+    /**
+     * @brief Split the single-library data file into buckets, one per shard
+     * @details Used the first time, when no shard has a data file yet
+     */
+    static void splitCatalog(const string& dataFile, vector<vector<Book> >& buckets) {
+        FilePersistence source(dataFile);
+        bool loaded = source.load([&](const Book& book) {
+            buckets[shardOf(book.isbn, buckets.size())].push_back(book);
+        });
+        if (!loaded) {
+            cout << "No previous data file found, using default data" << endl;
+            Book defaults[] = {
+                Book("C++ Programming", "Ahmed Ali", "111111", "Programming", 2023, 5),
+                Book("Data Structures", "Sarah Mohamed", "222222", "Programming", 2022, 3),
+                Book("Mathematics", "Dr. Sami", "333333", "Science", 2021, 2)
+            };
+            for (const auto& book : defaults) buckets[shardOf(book.isbn, buckets.size())].push_back(book);
+        }
+    }
+
+    /**
+     * @brief Split the files of an oldCount-shard layout into new buckets
+     * @details The old shard files are removed once read; the new shards
+     *          write their own files when the buckets are imported
+     */
+    static void splitShards(const string& dataFile, size_t oldCount, vector<vector<Book> >& buckets) {
+        cout << "Re-partitioning " << oldCount << " shards into " << buckets.size() << endl;
+        for (size_t i = 0; i < oldCount; i++) {
+            string fileName = shardFileName(dataFile, i);
+            FilePersistence source(fileName);
+            source.load([&](const Book& book) {
+                buckets[shardOf(book.isbn, buckets.size())].push_back(book);
+            });
+            remove(fileName.c_str());
+        }
+    }
+
+    /**
+     * @brief Add every bucket to its shard in parallel
+     * @details Every shard saves, even an empty one, so the next start
+     *          loads the shards instead of importing again. Buckets are
+     *          moved into the tasks, not copied.
+     */
+    void importBuckets(vector<vector<Book> >& buckets) {
+        vector<future<bool> > pending;
+        for (size_t i = 0; i < shards.size(); i++) {
+            Shard* target = shards[i].get();
+            pending.push_back(shards[i]->worker.submit([target, bucket = move(buckets[i])] {
+                lock_guard<mutex> guard(target->lock);
+                target->library->addBooks(bucket);
+                return true;
+            }));
+        }
+        for (auto& result : pending) result.get();
+    }
+
+public:
+    /**
+     * @brief Constructor - opens every shard and builds the title directory
+     * @param shardCount Number of shards (0 means the count of the last run,
+     *        or one per hardware thread the first time)
+     * @param dataFile Single-library data file, split into shards on first use
+     */
+    explicit ShardedLibrary(size_t shardCount = 0, const string& dataFile = "library_data.txt") {
+        size_t storedCount = keepsLayout ? readLayout(dataFile) : 0;
+        if (shardCount == 0) shardCount = storedCount ? storedCount : max(1u, thread::hardware_concurrency());
+
+        // A different shard count moves books between shards: read the old
+        // files before the new shards open (and would load) them
+        vector<vector<Book> > buckets(shardCount);
+        bool import = false;
+        if (storedCount != 0 && storedCount != shardCount) {
+            splitShards(dataFile, storedCount, buckets);
+            import = true;
+        }
+
+        for (size_t i = 0; i < shardCount; i++) {
+            unique_ptr<Shard> shard(new Shard);
+            shard->library.reset(new ShardLibrary(shardFileName(dataFile, i)));
+            shards.push_back(move(shard));
+        }
+
+        // First run: no shard found its data file (an emptied catalog still has files)
+        if (!import) {
+            vector<bool> loaded = scatter([](ShardLibrary& library) { return library.loadedFromFile(); });
+            if (find(loaded.begin(), loaded.end(), true) == loaded.end()) {
+                splitCatalog(dataFile, buckets);
+                import = true;
+            }
+        }
+        if (import) importBuckets(buckets);
+        if (keepsLayout && storedCount != shardCount) writeLayout(dataFile, shardCount);
+
+        vector<vector<string> > shardTitles = scatter([](ShardLibrary& library) { return library.titles(); });
+        for (size_t i = 0; i < shardTitles.size(); i++) {
+            for (const auto& title : shardTitles[i]) stripeOf(title).titleShards[title].push_back(i);
+        }
+    }
+
+    ShardedLibrary(const ShardedLibrary&) = delete;
+    ShardedLibrary& operator=(const ShardedLibrary&) = delete;
+
+    size_t shardCount() const { return shards.size(); }
+
+    // ==================== Routed Operations ====================
+
+    /**
+     * @brief Add new book to the shard that owns its ISBN
+     */
+    void addBook(string title, string author, string isbn, string category, int year, int copies) {
+        size_t shard = shardOf(isbn, shards.size());
+        onShard(shard, [&](ShardLibrary& library) {
+            library.addBook(title, author, isbn, category, year, copies);
+            return true;
+        });
+        recordTitle(title, shard);
+    }
+
+    /**
+     * @brief Borrow from the first owning shard that still has a copy
+     * @return true if borrowed, false otherwise
+     */
+    bool borrowBook(string title) {
+        size_t shard;
+        for (size_t rank = 0; route(title, rank, shard); rank++) {
+            // Check and borrow under one shard lock, so no other request runs in between
+            bool borrowed = onShard(shard, [&title](ShardLibrary& library) {
+                return library.hasAvailableCopy(title) && library.borrowBook(title);
+            });
+            if (borrowed) return true;
+        }
+        cout << "Book not available: " << title << endl;
+        return false;
+    }
+
+    /**
+     * @brief Return a book to its owning shard
+     * @return true if returned, false otherwise
+     */
+    bool returnBook(string title) {
+        size_t shard;
+        if (!route(title, 0, shard)) {
+            cout << "Book not found: " << title << endl;
+            return false;
+        }
+        return onShard(shard, [&title](ShardLibrary& library) { return library.returnBook(title); });
+    }
+
+    /**
+     * @brief Delete a book from its owning shard
+     * @return true if deleted, false otherwise
+     */
+    bool deleteBook(string title) {
+        size_t shard;
+        if (!route(title, 0, shard)) {
+            cout << "Book not found: " << title << endl;
+            return false;
+        }
+        if (!onShard(shard, [&title](ShardLibrary& library) { return library.deleteBook(title); })) {
+            return false;
+        }
+        forgetTitle(title, shard);
+        lock_guard<mutex> guard(historyLock);
+        deletedShards.push(shard);
+        return true;
+    }
+
+    /**
+     * @brief Restore last deleted book in the shard it was deleted from
+     * @details The shard reports which title it restored, since concurrent
+     *          deletes may reach its own stack in a different order
+     * @return true if a book was restored, false otherwise
+     */
+    bool restoreBook() {
+        size_t shard;
+        {
+            lock_guard<mutex> guard(historyLock);
+            if (deletedShards.empty()) {
+                cout << "No deleted books to restore" << endl;
+                return false;
+            }
+            shard = deletedShards.top();
+            deletedShards.pop();
+        }
+        string restoredTitle;
+        if (!onShard(shard, [&restoredTitle](ShardLibrary& library) { return library.restoreBook(restoredTitle); })) {
+            return false;
+        }
+        recordTitle(restoredTitle, shard);
+        return true;
+    }
+
+    // ==================== Scatter-Gather Operations ====================
+
+    /**
+     * @brief Search every shard for a title and record the request
+     * @return true if found, false otherwise
+     */
+    bool searchByTitle(string title) {
+        {
+            lock_guard<mutex> guard(queueLock);
+            searchRequests.push(title);
+        }
+        vector<bool> found = scatter([title](ShardLibrary& library) { return library.hasTitle(title); });
+        bool any = find(found.begin(), found.end(), true) != found.end();
+        cout << (any ? "Book found: " : "Book not found: ") << title << endl;
+        return any;
+    }
+
+    /**
+     * @brief Search every shard by author
+     * @return true if at least one book was found, false otherwise
+     */
+    bool searchByAuthor(string author) {
+        vector<vector<Book> > found = scatter([author](ShardLibrary& library) {
+            return library.booksByAuthor(author);
+        });
+        bool any = false;
+        for (const auto& books : found) {
+            for (const auto& book : books) {
+                if (!any) cout << "Books by " << author << ":" << endl;
+                book.display();
+                any = true;
+            }
+        }
+        if (!any) cout << "No books by: " << author << endl;
+        return any;
+    }
+
+    /**
+     * @brief Process all search requests in queue
+     */
+    void processSearchQueue() {
+        queue<string> pending;
+        {
+            lock_guard<mutex> guard(queueLock);
+            swap(pending, searchRequests);
+        }
+        if (pending.empty()) {
+            cout << "No search requests" << endl;
+            return;
+        }
+        cout << "Processing Search Queue:" << endl;
+        while (!pending.empty()) {
+            string title = pending.front();
+            pending.pop();
+            vector<bool> found = scatter([title](ShardLibrary& library) { return library.hasTitle(title); });
+            bool any = find(found.begin(), found.end(), true) != found.end();
+            cout << (any ? "Book found: " : "Book not found: ") << title << endl;
+        }
+    }
+
+    /**
+     * @brief Display all books, shard by shard
+     */
+    void displayAllBooks() {
+        vector<vector<Book> > shardBooks = scatter([](ShardLibrary& library) { return library.allBooks(); });
+        bool any = false;
+        for (const auto& books : shardBooks) {
+            for (const auto& book : books) {
+                if (!any) cout << "All Books:" << endl;
+                book.display();
+                any = true;
+            }
+        }
+        if (!any) cout << "No books in library" << endl;
+    }
+
+    /**
+     * @brief All books sorted by title (k-way merge of sorted shard listings)
+     */
+    vector<Book> sortedBooks() {
+        vector<vector<Book> > shardBooks = scatter([](ShardLibrary& library) { return library.sortedBooks(); });
+
+        // Heap entry: (shard, position); smallest title first, ties by shard
+        typedef pair<size_t, size_t> Cursor;
+        auto later = [&shardBooks](const Cursor& a, const Cursor& b) {
+            const string& titleA = shardBooks[a.first][a.second].title;
+            const string& titleB = shardBooks[b.first][b.second].title;
+            return titleA != titleB ? titleA > titleB : a.first > b.first;
+        };
+        priority_queue<Cursor, vector<Cursor>, decltype(later)> heap(later);
+        size_t total = 0;
+        for (size_t i = 0; i < shardBooks.size(); i++) {
+            if (!shardBooks[i].empty()) heap.push(Cursor(i, 0));
+            total += shardBooks[i].size();
+        }
+
+        vector<Book> merged;
+        merged.reserve(total);
+        while (!heap.empty()) {
+            Cursor next = heap.top();
+            heap.pop();
+            merged.push_back(move(shardBooks[next.first][next.second]));
+            if (next.second + 1 < shardBooks[next.first].size()) {
+                heap.push(Cursor(next.first, next.second + 1));
+            }
+        }
+        return merged;
+    }
+
+    /**
+     * @brief Display all books sorted by title
+     */
+    void displaySortedBooks() {
+        vector<Book> books = sortedBooks();
+        if (books.empty()) {
+            cout << "No books in library" << endl;
+            return;
+        }
+        cout << "Books Sorted by Title:" << endl;
+        for (const auto& book : books) book.display();
+    }
+
+    /**
+     * @brief Display statistics summed over all shards
+     */
+    void displayStatistics() {
+        vector<LibraryStats> shardStats = scatter([](ShardLibrary& library) { return library.statistics(); });
+        LibraryStats stats;
+        for (const auto& shard : shardStats) {
+            stats.totalBooks += shard.totalBooks;
+            stats.availableBooks += shard.availableBooks;
+            stats.deletedBooks += shard.deletedBooks;
+        }
+        {
+            lock_guard<mutex> guard(queueLock);
+            stats.searchRequests = searchRequests.size();
+        }
+        cout << "Library Statistics:" << endl;
+        cout << "Shards: " << shards.size() << endl;
+        cout << "Total Books: " << stats.totalBooks << endl;
+        cout << "Available Books: " << stats.availableBooks << endl;
+        cout << "Deleted Books: " << stats.deletedBooks << endl;
+        cout << "Search Requests: " << stats.searchRequests << endl;
+    }
+};
+
+#endif
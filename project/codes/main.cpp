@@ -3,7 +3,7 @@
  * @brief Main Interface for Library Management System
  */
 
-#include "Library.h"
+#include "LibraryCore.h"
 #include <iostream>
 using namespace std;
 
@@ -34,7 +34,7 @@ void displayMenu() {
  * @brief Main function - program entry point
  */
 int main() {
-    Library library;
+    CirculationLibrary library;
     int choice;
     
     do {
@@ -82,17 +82,17 @@ int main() {
                 break;
             case 9:
                 cout << "Title: "; getline(cin, title);
-                cout << (library.linearSearch(title) ? "Found (Linear)" : "Not found (Linear)") << endl;
+                cout << (linearSearch(library.allBooks(), title) ? "Found (Linear)" : "Not found (Linear)") << endl;
                 break;
             case 10:
                 cout << "Title: "; getline(cin, title);
-                cout << (library.binarySearch(title) ? "Found (Binary)" : "Not found (Binary)") << endl;
+                cout << (binarySearch(library.allBooks(), title) ? "Found (Binary)" : "Not found (Binary)") << endl;
                 break;
             case 11:
-                library.bubbleSort();
+                bubbleSort(library.allBooks());
                 break;
             case 12:
-                library.selectionSort();
+                selectionSort(library.allBooks());
                 break;
             case 13:
                 library.displayStatistics();